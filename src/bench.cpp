@@ -0,0 +1,406 @@
+#define DIM 2
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <map>
+#include <cmath>
+#include <algorithm>
+#include <filesystem>
+#include <sys/resource.h>
+#include "eigen3/Eigen/Core"
+#include "Set/Set.H"
+#include "Model/Isotropic.H"
+#include "Mesh/Unstructured.H"
+#include "Mesh/Operator.H"
+#include "Mesh/Constraint.H"
+#include "Mesh/Generate.H"
+#include "Util/Profile.H"
+
+//
+// Usage:  bin/bench [options]
+//
+//    --min N          smallest number of degrees of freedom    (1000)
+//    --max N          largest number of degrees of freedom     (1e7)
+//    --types LIST     element types, from cst,q4,lst,q9        (all)
+//    --meshes LIST    structured and/or refined                (both)
+//    --repeat R       number of timed runs of each phase       (3)
+//    --solver S       ldlt, iccg, jacobicg, matrixfree, none   (ldlt)
+//    --solve-max N    skip the solve above N degrees of freedom (1e6)
+//    --ordering O     none, rcm, hilbert, morton               (none)
+//    --threads T      assembly threads                         (1)
+//    --csv FILE       write the results as CSV                 (bench.csv)
+//    --json FILE      write the results as JSON                (bench.json)
+//
+// For every element type this runs two families of meshes:
+//
+//    structured  the unit square, n x n, with n chosen so that the
+//                number of degrees of freedom is closest to each power
+//                of ten between --min and --max
+//    refined     platehole_<type>.vtk (from the working directory),
+//                split uniformly into four again and again (see
+//                Mesh::Generate) for as long as the mesh stays below --max
+//
+// Each mesh is written to a temporary binary VTK file, and then every
+// phase is timed --repeat times:
+//
+//    load      reading the mesh (Mesh::Unstructured constructor)
+//    renumber  node renumbering of the mesh just read (only with --ordering)
+//    W, DW     energy and its derivative
+//    symbolic  stiffness matrix pattern (Mesh::Unstructured::Symbolic)
+//    DDW       stiffness matrix values
+//    bc        setting up the boundary conditions (left side fixed,
+//              right side displaced) and reducing the system
+//    solve     solving the reduced system with a new Mesh::Constraint,
+//              i.e. including the symbolic reduction (the map from K
+//              to K_ff) and, with LDLT, the symbolic analysis
+//    resolve   solving again with the same Constraint and the same
+//              pattern of K, as in later Newton steps: only the values
+//              are reduced and, with LDLT, refactorized (not with
+//              matrixfree, which has nothing to reuse)
+//    print     writing the solution and fields (binary VTK)
+//
+// along with the peak resident memory and the number of nonzeros of
+// the stiffness matrix. Min, median, and mean times are written to the
+// CSV and JSON files; their "level" is n for the structured meshes and
+// the number of refinements for the refined ones.
+//
+// Building with "make -B PROFILE=1 bin/bench" also prints the per-phase
+// breakdown of the timers in the hot paths (see Util/Profile.H) after
+// every mesh, and adds it to the JSON file.
+//
+
+typedef Mesh::Unstructured<Model::Isotropic> MESH;
+typedef Mesh::Constraint<MESH> Constraint;
+
+struct Phase
+{
+    std::string name;
+    std::vector<double> ms;
+    int iterations = -1;
+};
+
+struct Case
+{
+    std::string type, family;
+    int level;
+    long dofs = 0, elements = 0, nnz = 0;
+    double rss = 0.0; // peak resident memory [MB]
+    std::vector<Phase> phases;
+    std::map<std::string,Util::Profile::Entry> profile;
+};
+
+// Reset the peak resident memory (Linux only; otherwise the peak is
+// over the whole run so far).
+void ResetPeakRSS()
+{
+    std::ofstream clear("/proc/self/clear_refs");
+    if (clear) clear << "5";
+}
+
+// Peak resident memory in MB
+double PeakRSS()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (getline(status, line))
+        if (line.rfind("VmHWM:", 0) == 0) return std::stod(line.substr(6)) / 1024.0;
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;
+}
+
+double Min(const std::vector<double> &v) {return *std::min_element(v.begin(), v.end());}
+double Mean(const std::vector<double> &v) {double s = 0; for (double x : v) s += x; return s / v.size();}
+double Median(std::vector<double> v)
+{
+    std::sort(v.begin(), v.end());
+    return v.size() % 2 ? v[v.size()/2] : 0.5 * (v[v.size()/2 - 1] + v[v.size()/2]);
+}
+
+template<class F>
+double Time(F &&f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::vector<std::string> Split(std::string list)
+{
+    std::vector<std::string> ret;
+    std::stringstream ss(list);
+    std::string item;
+    while (getline(ss, item, ',')) ret.push_back(item);
+    return ret;
+}
+
+int main(int argc, char **argv)
+{
+    std::map<std::string,std::string> options = {
+        {"min", "1000"}, {"max", "1e7"}, {"types", "cst,q4,lst,q9"}, {"meshes", "structured,refined"},
+        {"repeat", "3"}, {"solver", "ldlt"}, {"solve-max", "1e6"}, {"ordering", "none"}, {"threads", "1"},
+        {"csv", "bench.csv"}, {"json", "bench.json"}};
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg.rfind("--", 0) != 0 || !options.count(arg.substr(2)) || i + 1 >= argc)
+        {
+            std::cout << "Unknown or incomplete option " << arg << " (see src/bench.cpp)" << std::endl;
+            return 1;
+        }
+        options[arg.substr(2)] = argv[++i];
+    }
+    const long mindofs = std::stod(options["min"]), maxdofs = std::stod(options["max"]);
+    const long solvemax = std::stod(options["solve-max"]);
+    const int repeat = std::max(1, std::stoi(options["repeat"]));
+    const int nthreads = std::stoi(options["threads"]);
+    const std::string solver = options["solver"], ordering = options["ordering"];
+
+    std::map<std::string, Constraint::Solver> solvers =
+        {{"ldlt", Constraint::LDLT}, {"iccg", Constraint::ICCG}, {"jacobicg", Constraint::JacobiCG}};
+    std::map<std::string, MESH::Ordering> orderings =
+        {{"rcm", MESH::RCM}, {"hilbert", MESH::Hilbert}, {"morton", MESH::Morton}};
+    if (solver != "matrixfree" && solver != "none" && !solvers.count(solver))
+    {
+        std::cout << "Unknown solver " << solver << std::endl;
+        return 1;
+    }
+    if (ordering != "none" && !orderings.count(ordering))
+    {
+        std::cout << "Unknown ordering " << ordering << std::endl;
+        return 1;
+    }
+
+    std::map<std::string,int> linear = {{"cst", 5}, {"q4", 9}, {"lst", 5}, {"q9", 9}};
+    std::string meshfile = (std::filesystem::temp_directory_path() / "pffe_bench_mesh.vtk").string();
+    std::string outfile = (std::filesystem::temp_directory_path() / "pffe_bench_output.vtk").string();
+    std::vector<Case> cases;
+
+    auto run = [&](Case c, std::vector<Set::Vector> &points, std::vector<int> &cells, std::vector<int> &types)
+    {
+        ResetPeakRSS();
+        Mesh::VTK::Write(meshfile, points, cells, types, {}, {}, Mesh::VTK::BINARY);
+        Util::Profile::Reset();
+        {
+            // Free the generated mesh while this one runs
+            std::vector<Set::Vector>().swap(points);
+            std::vector<int>().swap(cells);
+            std::vector<int>().swap(types);
+        }
+        // Time f() "repeat" times, each time after an (untimed) setup()
+        auto prepared = [&](std::string name, auto &&setup, auto &&f)
+        {
+            Phase p{name, {}};
+            for (int r = 0; r < repeat; r++)
+            {
+                setup();
+                p.ms.push_back(Time(f));
+            }
+            c.phases.push_back(p);
+            return &c.phases.back();
+        };
+        auto phase = [&](std::string name, auto &&f) {return prepared(name, []() {}, f);};
+
+        // The previous mesh is freed before the next one is read, so that
+        // the peak memory is that of a single mesh.
+        std::unique_ptr<MESH> mesh;
+        prepared("load", [&]() {mesh.reset();}, [&]() {mesh = std::make_unique<MESH>(meshfile);});
+        c.dofs = mesh->size();
+        c.elements = mesh->nElements();
+        std::cout << c.type << " " << c.family << " " << c.level << ": " << c.dofs << " dofs, "
+                  << c.elements << " elements" << std::flush;
+
+        if (ordering != "none")
+            prepared("renumber", [&]() {mesh.reset(); mesh = std::make_unique<MESH>(meshfile);},
+                     [&]() {mesh->Renumber(orderings[ordering]);});
+        mesh->Threads(nthreads);
+
+        Eigen::VectorXd disp = Eigen::VectorXd::Zero(mesh->size()), DW;
+        Eigen::SparseMatrix<double> K;
+        volatile double w = 0.0;
+        phase("W", [&]() {w = w + mesh->W(disp);});
+        phase("DW", [&]() {DW = mesh->DW(disp);});
+        phase("symbolic", [&]() {mesh->Symbolic();});
+        phase("DDW", [&]() {mesh->DDW(disp, K);});
+        c.nnz = K.nonZeros();
+
+        Set::Scalar du = 0.01;
+        auto boundary = [&](Constraint &bc)
+        {
+            bc.Fix(bc.Plane(0, 0.0), Set::Vector(0.0, 0.0));
+            bc.Fix(bc.Plane(0, 1.0), Set::Vector(0.0, -du));
+        };
+        phase("bc", [&]()
+        {
+            Constraint bc(*mesh);
+            boundary(bc);
+            Eigen::SparseMatrix<double> Kff;
+            Eigen::VectorXd bf;
+            bc.Reduce(K, DW, Kff, bf);
+        });
+
+        if (solver != "none" && c.dofs <= solvemax)
+        {
+            // Every timed solve gets a new constraint (set up untimed), so
+            // that nothing is reused from the previous repeat.
+            std::unique_ptr<Constraint> bc;
+            auto constraint = [&]()
+            {
+                bc.reset();
+                bc = std::make_unique<Constraint>(*mesh);
+                boundary(*bc);
+            };
+            Phase *p;
+            if (solver != "matrixfree")
+            {
+                p = prepared("solve", constraint, [&]() {disp = bc->Solve(K, DW, solvers[solver]);});
+                if (solver != "ldlt") p->iterations = bc->iterations;
+                p = phase("resolve", [&]() {disp = bc->Solve(K, DW, solvers[solver]);});
+                if (solver != "ldlt") p->iterations = bc->iterations;
+            }
+            else
+            {
+                int iterations = 0;
+                Eigen::VectorXd zero = Eigen::VectorXd::Zero(mesh->size());
+                p = prepared("solve", constraint, [&]()
+                {
+                    mesh->Cache();
+                    Mesh::Operator<MESH> op(*mesh, zero, bc->Fixed());
+                    Eigen::ConjugateGradient<Mesh::Operator<MESH>, Eigen::Lower|Eigen::Upper,
+                                             Mesh::JacobiPreconditioner> cg;
+                    cg.setTolerance(1E-10);
+                    cg.compute(op);
+                    disp = cg.solve(op.RHS(DW, bc->Prescribed()));
+                    iterations = cg.iterations();
+                    if (cg.info() != Eigen::Success)
+                        throw Util::Exception::Numeric("matrix-free CG did not converge");
+                });
+                p->iterations = iterations;
+            }
+        }
+
+        phase("print", [&]() {mesh->Print(outfile, disp, Mesh::VTK::BINARY, true);});
+
+        mesh.reset();
+        c.rss = PeakRSS();
+        c.profile = Util::Profile::Table();
+        std::cout << ", " << c.nnz << " nonzeros, " << c.rss << " MB" << std::endl;
+        for (auto &p : c.phases)
+            printf("    %-10s %12.3f ms%s\n", p.name.c_str(), Min(p.ms),
+                   p.iterations >= 0 ? (" (" + std::to_string(p.iterations) + " iterations)").c_str() : "");
+#ifdef PROFILE
+        Util::Profile::Print(stdout);
+#endif
+        cases.push_back(c);
+    };
+
+    for (std::string type : Split(options["types"]))
+    {
+        if (!linear.count(type))
+        {
+            std::cout << "Unknown element type " << type << std::endl;
+            return 1;
+        }
+        const bool quadratic = type == "lst" || type == "q9";
+        for (std::string family : Split(options["meshes"]))
+        {
+            std::vector<Set::Vector> points;
+            std::vector<int> cells, types;
+            if (family == "structured")
+            {
+                for (long target = 1000; target <= maxdofs; target *= 10)
+                {
+                    if (target < mindofs) continue;
+                    // dofs = 2 (n+1)^2 for CST and Q4, and 2 (2n+1)^2 for LST and Q9
+                    double nodes = std::sqrt(target / 2.0);
+                    int n = std::max(1, (int)std::lround(quadratic ? (nodes - 1) / 2 : nodes - 1));
+                    Mesh::Generate::Square(linear[type], n, points, cells, types);
+                    if (quadratic) Mesh::Generate::Quadratic(points, cells, types);
+                    run(Case{type, family, n}, points, cells, types);
+                }
+            }
+            else if (family == "refined")
+            {
+                std::string file = "platehole_" + type + ".vtk";
+                if (!std::filesystem::exists(file))
+                {
+                    std::cout << "Skipping refined " << type << " meshes: " << file << " not found" << std::endl;
+                    continue;
+                }
+                std::vector<Set::Vector> base;
+                std::vector<int> basecells, basetypes;
+                Mesh::VTK::Read(file, base, basecells, basetypes);
+                Mesh::Generate::Linear(base, basecells, basetypes);
+                for (int level = 0; ; level++)
+                {
+                    if (level > 0) Mesh::Generate::Refine(base, basecells, basetypes);
+                    points = base; cells = basecells; types = basetypes;
+                    if (quadratic) Mesh::Generate::Quadratic(points, cells, types);
+                    if (2 * (long)points.size() > maxdofs) break;
+                    if (2 * (long)points.size() < mindofs) continue;
+                    run(Case{type, family, level}, points, cells, types);
+                }
+            }
+            else
+            {
+                std::cout << "Unknown mesh family " << family << std::endl;
+                return 1;
+            }
+        }
+    }
+    std::filesystem::remove(meshfile);
+    std::filesystem::remove(outfile);
+
+    //
+    // CSV: one row per mesh and phase
+    //
+    std::ofstream csv(options["csv"]);
+    csv << "element,mesh,level,dofs,elements,nnz,peak_rss_mb,phase,repeats,min_ms,median_ms,mean_ms,iterations\n";
+    for (auto &c : cases)
+        for (auto &p : c.phases)
+            csv << c.type << "," << c.family << "," << c.level << "," << c.dofs << "," << c.elements << ","
+                << c.nnz << "," << c.rss << "," << p.name << "," << p.ms.size() << ","
+                << Min(p.ms) << "," << Median(p.ms) << "," << Mean(p.ms) << ","
+                << (p.iterations >= 0 ? std::to_string(p.iterations) : "") << "\n";
+
+    //
+    // JSON: one object per mesh
+    //
+    std::ofstream json(options["json"]);
+    json << "{\n  \"options\": {";
+    for (auto it = options.begin(); it != options.end(); it++)
+        json << (it == options.begin() ? "" : ", ") << "\"" << it->first << "\": \"" << it->second << "\"";
+    json << "},\n  \"cases\": [";
+    for (int i = 0; i < cases.size(); i++)
+    {
+        Case &c = cases[i];
+        json << (i ? "," : "") << "\n    {\"element\": \"" << c.type << "\", \"mesh\": \"" << c.family
+             << "\", \"level\": " << c.level << ", \"dofs\": " << c.dofs << ", \"elements\": " << c.elements
+             << ", \"nnz\": " << c.nnz << ", \"peak_rss_mb\": " << c.rss << ",\n     \"phases\": {";
+        for (int j = 0; j < c.phases.size(); j++)
+        {
+            Phase &p = c.phases[j];
+            json << (j ? ", " : "") << "\"" << p.name << "\": {\"repeats\": " << p.ms.size()
+                 << ", \"min_ms\": " << Min(p.ms) << ", \"median_ms\": " << Median(p.ms)
+                 << ", \"mean_ms\": " << Mean(p.ms);
+            if (p.iterations >= 0) json << ", \"iterations\": " << p.iterations;
+            json << "}";
+        }
+        json << "}";
+        if (c.profile.size())
+        {
+            json << ",\n     \"profile\": {";
+            for (auto it = c.profile.begin(); it != c.profile.end(); it++)
+                json << (it == c.profile.begin() ? "" : ", ") << "\"" << it->first << "\": {\"calls\": "
+                     << it->second.calls << ", \"total_ms\": " << 1000.0 * it->second.seconds
+                     << ", \"count\": " << it->second.count << "}";
+            json << "}";
+        }
+        json << "}";
+    }
+    json << "\n  ]\n}\n";
+
+    std::cout << "Wrote " << options["csv"] << " and " << options["json"] << std::endl;
+}
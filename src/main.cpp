@@ -1,6 +1,7 @@
 #define DIM 2
 
 #include <iostream>
+#include <map>
 #include "eigen3/Eigen/Core"
 #include "eigen3/Eigen/Dense"
 #include "Set/Set.H"
@@ -13,14 +14,60 @@
 #include "Model/Test.H"
 #include "Mesh/Unstructured.H"
 #include "Mesh/Test.H"
+#include "Mesh/Operator.H"
+#include "Mesh/Constraint.H"
+#include "Util/Profile.H"
 
 
 int main(int argc, char **argv)
 {
+    //
+    // Usage:  bin/main [meshfile] [ldlt|iccg|jacobicg|matrixfree] [none|rcm|hilbert|morton]
+    //
+    // The first three form the global stiffness matrix, eliminate the
+    // constrained degrees of freedom, and solve the (symmetric positive
+    // definite) reduced system with:
+    //     ldlt       sparse Cholesky factorization (the default)
+    //     iccg       conjugate gradient, incomplete Cholesky preconditioner
+    //     jacobicg   conjugate gradient, Jacobi preconditioner
+    // "matrixfree" never forms the stiffness matrix; it solves with
+    // conjugate gradient using the matrix-free operator and a Jacobi
+    // preconditioner.
+    //
+    // The last argument optionally renumbers the nodes after the mesh is
+    // read (see Mesh::Unstructured::Renumber).
+    //
+    std::string meshfile = argc > 1 ? argv[1] : "platehole_q9.vtk";
+    std::string method = argc > 2 ? argv[2] : "ldlt";
+    std::string ordering = argc > 3 ? argv[3] : "none";
+    typedef Mesh::Constraint<Mesh::Unstructured<Model::Isotropic>> Constraint;
+    std::map<std::string, Constraint::Solver> solvers =
+        {{"ldlt", Constraint::LDLT}, {"iccg", Constraint::ICCG}, {"jacobicg", Constraint::JacobiCG}};
+    if (method != "matrixfree" && !solvers.count(method))
+    {
+        std::cout << "Unknown solution method " << method << " (use ldlt, iccg, jacobicg, or matrixfree)" << std::endl;
+        return 1;
+    }
+
     //
     // Create an unstructured mesh
     //
-    Mesh::Unstructured<Model::Isotropic> mymesh("platehole_q9.vtk");
+    Mesh::Unstructured<Model::Isotropic> mymesh(meshfile);
+
+    std::map<std::string, Mesh::Unstructured<Model::Isotropic>::Ordering> orderings =
+        {{"rcm", mymesh.RCM}, {"hilbert", mymesh.Hilbert}, {"morton", mymesh.Morton}};
+    if (ordering != "none")
+    {
+        if (!orderings.count(ordering))
+        {
+            std::cout << "Unknown ordering " << ordering << " (use none, rcm, hilbert, or morton)" << std::endl;
+            return 1;
+        }
+        std::cout << "Bandwidth " << mymesh.Bandwidth() << ", profile " << mymesh.Profile() << std::endl;
+        mymesh.Renumber(orderings[ordering]);
+        std::cout << "Renumbered (" << ordering << "): bandwidth " << mymesh.Bandwidth()
+                  << ", profile " << mymesh.Profile() << std::endl;
+    }
 
     //
     // Create a displacement vector to store nodal displacements
@@ -28,55 +75,55 @@ int main(int argc, char **argv)
     Eigen::VectorXd  disp = Eigen::VectorXd::Zero(mymesh.size());
 
     //
-    // Calculate the first and second energy derivatives
+    // Calculate the first energy derivative
     //
     Eigen::VectorXd DW = mymesh.DW(disp);
-    Eigen::SparseMatrix<double> DDW = mymesh.DDW(disp);
 
     //
-    // Modify the stiffness matrix to apply essential (displacement)
-    // boundary conditions at the leftmost and rightmost nodes.
+    // Essential (displacement) boundary conditions at the leftmost
+    // and rightmost nodes.
     //
     Set::Scalar du = 0.01; // the prescribed displacement
-    for (int i = 0 ; i < mymesh.Points.size(); i++)
-    {
-        // Do this for all points on the left side (x=0)
-        if (fabs(mymesh.Points[i](0) - 0.0) < 1E-8)
-        {
-            // x component of displacement
-            DDW.row(2*i) *= 0;                      // Zero out this row of the stiffness matrix
-            DDW.coeffRef(2*i,2*i) = 1.0;            // and then set the diagonal to one.
-            DW(2*i) = 0.0;                          // Set the right-hand side to "-du"
-
-            // y component of displacement ... same thing as z but with disp = 0
-            DDW.row(2*i + 1) *= 0;
-            DDW.coeffRef(2*i + 1,2*i + 1) = 1.0;
-            DW(2*i + 1) = 0.0;
-        }
-
+    Constraint bc(mymesh);
+    bc.Fix(bc.Plane(0, 0.0), Set::Vector(0.0, 0.0));   // left side (x=0): fixed
+    bc.Fix(bc.Plane(0, 1.0), Set::Vector(0.0, -du));   // right side (x=1): displaced down
 
-        // Do this for all points on the right side (x1)
-        // Same thing as for the right side but with positive displacement rather than negative.
-        if (fabs(mymesh.Points[i](0) - 1.0) < 1E-8)
-        {
-            DDW.row(2*i) *= 0;
-            DDW.coeffRef(2*i,2*i) = 1.0;
-            DW(2*i) = 0.0;
+    if (method != "matrixfree")
+    {
+        Eigen::SparseMatrix<double> DDW = mymesh.DDW(disp);
 
-            DDW.row(DIM*i + 1) *= 0;
-            DDW.coeffRef(DIM*i + 1,DIM*i + 1) = 1.0;
-            DW(DIM*i + 1) = -du;
-        }
+        // Solve DDW u = DW with the constrained values eliminated
+        disp = bc.Solve(DDW, DW, solvers[method]);
+    }
+    else
+    {
+        // The operator is applied many times, so it pays to cache the geometry.
+        mymesh.Cache();
+
+        // Matrix-free stiffness operator with the boundary conditions
+        // eliminated symmetrically, so that CG can be used.
+        Mesh::Operator<Mesh::Unstructured<Model::Isotropic>> DDW(mymesh, disp, bc.Fixed());
+        Eigen::VectorXd rhs = DDW.RHS(DW, bc.Prescribed());
+
+        Eigen::ConjugateGradient<Mesh::Operator<Mesh::Unstructured<Model::Isotropic>>,
+                                 Eigen::Lower|Eigen::Upper,
+                                 Mesh::JacobiPreconditioner> solver;
+        solver.setTolerance(1E-10);
+        solver.compute(DDW);
+        disp = solver.solve(rhs);
+        std::cout << "CG iterations: " << solver.iterations() << ", error: " << solver.error() << std::endl;
+        if (solver.info() != Eigen::Success)
+            throw Util::Exception::Numeric("matrix-free CG did not converge");
     }
 
+    // Use the print function to output displacements, along with the
+    // strain, stress, and strain energy density.
+    mymesh.Print("q9_lever_outputfile.vtk", disp, Mesh::VTK::BINARY, true);
 
-    // Use the Eigen library to solve DDW u = DW
-    Eigen::BiCGSTAB<Eigen::SparseMatrix<double>> solver;
-    solver.compute(DDW);
-    disp = solver.solve(DW);
-
-    // Use the print function to output displacements.
-    mymesh.Print("q9_lever_outputfile.vtk", disp);
+#ifdef PROFILE
+    // Time spent in each phase of the run (built with make -B PROFILE=1)
+    Util::Profile::Print();
+#endif
 
 
     // TODO : Run this code as-is for the following mesh files
@@ -88,7 +135,9 @@ int main(int argc, char **argv)
 
     // TODO : Modify the boundary conditions to apply a cantilever displacement
     //        by setting the displacements to zero along the left edge, and
-    //        the y-displacement of the lower right-hand corner to -du.
+    //        the y-displacement of the lower right-hand corner to -du,
+    //        i.e. replace the right side constraint with
+    //            bc.Fix(bc.Nearest(Set::Vector(1.0, 0.0)), 1, -du);
     //        Plot and report the results.
 
 }
@@ -54,6 +54,10 @@ int main(int argc, char **argv)
     try {Element::Test<Element::CST<Model::Isotropic>>::EnergyDerivative(); std::cout <<"pass"<<std::endl;}
     catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
 
+    std::cout << "test.element.cst.storage...";
+    try {Element::Test<Element::CST<Model::Isotropic>>::Storage(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
     //
     // LST Tests
     //
@@ -82,6 +86,10 @@ int main(int argc, char **argv)
     try {Element::Test<Element::LST<Model::Isotropic>>::EnergyDerivative(); std::cout <<"pass"<<std::endl;}
     catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
 
+    std::cout << "test.element.lst.storage...";
+    try {Element::Test<Element::LST<Model::Isotropic>>::Storage(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
     //
     // Q4 Tests
     //
@@ -110,6 +118,10 @@ int main(int argc, char **argv)
     try {Element::Test<Element::Q4<Model::Isotropic>>::EnergyDerivative(); std::cout <<"pass"<<std::endl;}
     catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
 
+    std::cout << "test.element.q4.storage...";
+    try {Element::Test<Element::Q4<Model::Isotropic>>::Storage(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
     //
     // Q9 Tests
     //
@@ -138,6 +150,10 @@ int main(int argc, char **argv)
     try {Element::Test<Element::Q9<Model::Isotropic>>::EnergyDerivative(); std::cout <<"pass"<<std::endl;}
     catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
 
+    std::cout << "test.element.q9.storage...";
+    try {Element::Test<Element::Q9<Model::Isotropic>>::Storage(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
 
 
     //
@@ -145,6 +161,137 @@ int main(int argc, char **argv)
     // 
 
 
+    std::cout << "test.mesh.unstructured.reader.cst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Reader("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.reader.q4...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Reader("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.reader.lst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Reader("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.reader.q9...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Reader("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.reader.platehole.cst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Reader("platehole_cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.reader.platehole.q4...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Reader("platehole_q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.reader.platehole.lst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Reader("platehole_lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.reader.platehole.q9...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Reader("platehole_q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+
+    std::cout << "test.mesh.unstructured.writer.cst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Writer("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.writer.q4...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Writer("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.writer.lst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Writer("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.writer.q9...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Writer("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.fields.cst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Fields("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.fields.q4...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Fields("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.fields.lst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Fields("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.fields.q9...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Fields("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+
+    std::cout << "test.mesh.unstructured.renumber.platehole.cst.rcm...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Renumber("platehole_cst.vtk", 0); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.renumber.platehole.cst.hilbert...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Renumber("platehole_cst.vtk", 1); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.renumber.platehole.cst.morton...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Renumber("platehole_cst.vtk", 2); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.renumber.platehole.q4.rcm...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Renumber("platehole_q4.vtk", 0); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.renumber.platehole.q4.hilbert...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Renumber("platehole_q4.vtk", 1); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.renumber.platehole.q4.morton...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Renumber("platehole_q4.vtk", 2); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.renumber.platehole.lst.rcm...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Renumber("platehole_lst.vtk", 0); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.renumber.platehole.lst.hilbert...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Renumber("platehole_lst.vtk", 1); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.renumber.platehole.lst.morton...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Renumber("platehole_lst.vtk", 2); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.renumber.platehole.q9.rcm...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Renumber("platehole_q9.vtk", 0); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.renumber.platehole.q9.hilbert...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Renumber("platehole_q9.vtk", 1); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.renumber.platehole.q9.morton...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Renumber("platehole_q9.vtk", 2); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.generate.cst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Synthetic("platehole_cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.generate.q4...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Synthetic("platehole_q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.generate.lst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Synthetic("platehole_lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.generate.q9...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Synthetic("platehole_q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+
     std::cout << "test.mesh.unstructured.cst...";
     try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Derivative("cst.vtk"); std::cout <<"pass"<<std::endl;}
     catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
@@ -153,6 +300,10 @@ int main(int argc, char **argv)
     try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Derivative("q4.vtk"); std::cout <<"pass"<<std::endl;}
     catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
 
+    std::cout << "test.mesh.unstructured.q4.orientation...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Orientation("platehole_q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
     
     std::cout << "test.mesh.unstructured.lst...";
     try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Derivative("lst.vtk"); std::cout <<"pass"<<std::endl;}
@@ -164,5 +315,139 @@ int main(int argc, char **argv)
     catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
 
 
+    std::cout << "test.mesh.unstructured.cst.threaded...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Derivative("cst.vtk", 4); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.q4.threaded...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Derivative("q4.vtk", 4); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.lst.threaded...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Derivative("lst.vtk", 4); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.q9.threaded...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Derivative("q9.vtk", 4); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+
+    std::cout << "test.mesh.unstructured.copy.q9...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Copy("platehole_q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.cache.cst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Cache("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.cache.q4...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Cache("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.cache.lst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Cache("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.cache.q9...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Cache("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.reassembly.cst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Reassembly("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.reassembly.q4...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Reassembly("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.reassembly.lst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Reassembly("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.reassembly.q9...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Reassembly("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.parallel.cst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Parallel("platehole_cst.vtk", 4); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.parallel.q4...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Parallel("platehole_q4.vtk", 4); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.parallel.lst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Parallel("platehole_lst.vtk", 4); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.parallel.q9...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Parallel("platehole_q9.vtk", 4); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.matrixfree.cst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::MatrixFree("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.matrixfree.q4...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::MatrixFree("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.matrixfree.lst...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::MatrixFree("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.matrixfree.q9...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::MatrixFree("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.dirichlet.cst.ldlt...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Dirichlet("platehole_cst.vtk", Mesh::Constraint<Mesh::Unstructured<Model::Isotropic>>::LDLT); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.dirichlet.cst.iccg...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Dirichlet("platehole_cst.vtk", Mesh::Constraint<Mesh::Unstructured<Model::Isotropic>>::ICCG); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.dirichlet.cst.jacobicg...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Dirichlet("platehole_cst.vtk", Mesh::Constraint<Mesh::Unstructured<Model::Isotropic>>::JacobiCG); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.dirichlet.q4.ldlt...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Dirichlet("platehole_q4.vtk", Mesh::Constraint<Mesh::Unstructured<Model::Isotropic>>::LDLT); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.dirichlet.q4.iccg...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Dirichlet("platehole_q4.vtk", Mesh::Constraint<Mesh::Unstructured<Model::Isotropic>>::ICCG); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.dirichlet.q4.jacobicg...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Dirichlet("platehole_q4.vtk", Mesh::Constraint<Mesh::Unstructured<Model::Isotropic>>::JacobiCG); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.dirichlet.lst.ldlt...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Dirichlet("platehole_lst.vtk", Mesh::Constraint<Mesh::Unstructured<Model::Isotropic>>::LDLT); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.dirichlet.lst.iccg...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Dirichlet("platehole_lst.vtk", Mesh::Constraint<Mesh::Unstructured<Model::Isotropic>>::ICCG); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.dirichlet.lst.jacobicg...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Dirichlet("platehole_lst.vtk", Mesh::Constraint<Mesh::Unstructured<Model::Isotropic>>::JacobiCG); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.dirichlet.q9.ldlt...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Dirichlet("platehole_q9.vtk", Mesh::Constraint<Mesh::Unstructured<Model::Isotropic>>::LDLT); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.dirichlet.q9.iccg...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Dirichlet("platehole_q9.vtk", Mesh::Constraint<Mesh::Unstructured<Model::Isotropic>>::ICCG); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.unstructured.dirichlet.q9.jacobicg...";
+    try {Mesh::Test<Mesh::Unstructured<Model::Isotropic>>::Dirichlet("platehole_q9.vtk", Mesh::Constraint<Mesh::Unstructured<Model::Isotropic>>::JacobiCG); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+
 
 }